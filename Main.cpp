@@ -8,12 +8,36 @@ enum class GameState {
 	GameClear
 };
 
+// プレイヤーの入力（キーボード・マウスまたはボットから与える）
+struct PlayerInput
+{
+	bool forward = false;
+	bool left = false;
+	bool backward = false;
+	bool right = false;
+	// 卵を燃やす（左クリック）
+	bool fire = false;
+};
+
+// プレイヤーの初期位置
+constexpr Vec3 PlayerStartPosition{ 100, 2, -16 };
+// スパイダーの初期位置
+constexpr Vec3 SpiderStartPosition{ 0, -0.62, 10 };
+// 2匹目以降のスパイダーをずらす量
+// プレイヤーの初期位置（x=100）から離れる-x方向に、当たり判定（x方向の幅約20）が重ならない間隔で並べる
+constexpr Vec3 ExtraSpiderOffset{ -24, 0, 0 };
+// プレイヤーの当たり判定の半径
+constexpr double PlayerRadius = 0.5;
+// プレイヤーとスパイダーの移動速度
+constexpr double PlayerSpeed = 8.0;
+constexpr double SpiderSpeed = 8.0;
+
 // プレイヤーの移動やカメラの制御を行うクラス
 class PlayerController
 {
 public:
 	// プレイヤーの位置
-	Vec3 m_eyePosition{ 100, 2, -16 };
+	Vec3 m_eyePosition = PlayerStartPosition;
 	Vec3 m_nextPosition{ 0, 0, 0 };
 	// 水平角度
 	double m_angle = 0_deg;
@@ -38,22 +62,33 @@ public:
 	}
 
 public:
-	// PlayerControllerクラス内のUpdatePositionメソッド
-	Vec3 UpdatePosition(const Box& boundingBox)
+	// キーボードとマウスの入力を取得
+	static PlayerInput GetKeyboardInput()
+	{
+		PlayerInput input;
+		input.forward = KeyW.pressed();
+		input.left = KeyA.pressed();
+		input.backward = KeyS.pressed();
+		input.right = KeyD.pressed();
+		input.fire = MouseL.down();
+		return input;
+	}
+
+	// 入力と経過時間を指定して移動する（キーボードとボットで共通）
+	Vec3 UpdatePosition(const Box& boundingBox, const PlayerInput& input, double deltaTime)
 	{
 		Vec3 moveDirection(0.0, 0.0, 0.0);
-		const double deltaTime = Scene::DeltaTime();
-		const double speed = deltaTime * 8.0;
+		const double speed = deltaTime * PlayerSpeed;
 
-		// WASDキーの入力に応じて移動方向を設定
-		if (KeyW.pressed()) { moveDirection += GetHorizontalXZDirection(m_angle); }
-		if (KeyA.pressed()) { moveDirection += GetHorizontalXZDirection(m_angle - 90_deg); }
-		if (KeyS.pressed()) { moveDirection -= GetHorizontalXZDirection(m_angle); }
-		if (KeyD.pressed()) { moveDirection += GetHorizontalXZDirection(m_angle + 90_deg); }
+		// WASDの入力に応じて移動方向を設定
+		if (input.forward) { moveDirection += GetHorizontalXZDirection(m_angle); }
+		if (input.left) { moveDirection += GetHorizontalXZDirection(m_angle - 90_deg); }
+		if (input.backward) { moveDirection -= GetHorizontalXZDirection(m_angle); }
+		if (input.right) { moveDirection += GetHorizontalXZDirection(m_angle + 90_deg); }
 
 		// 次の位置を計算
 		Vec3 nextPosition = m_eyePosition + moveDirection * speed;
-		Sphere nextPlayerSphere(nextPosition, 0.5);
+		Sphere nextPlayerSphere(nextPosition, PlayerRadius);
 
 		// バウンディングボックスとの衝突判定
 		if (!nextPlayerSphere.intersects(boundingBox))
@@ -94,10 +129,9 @@ public:
 };
 
 // スパイダーのバウンディングボックスを取得する関数
-Box GetSpiderBoundingBox(const Model& spiderModel, const Vec3& position)
+Box GetSpiderBoundingBox(const Box& spiderModelBox, const Vec3& position)
 {
-	// 元のスパイダーモデルのバウンディングボックスを取得
-	Box box = spiderModel.boundingBox();
+	Box box = spiderModelBox;
 	// サイズを少し大きくする
 	box = box.stretched(0.3);
 	// 現在のスパイダーの位置に移動させる
@@ -154,6 +188,506 @@ struct PSFog
 	float fogCoefficient;
 };
 
+//-------------------------------------------------------------------------
+// 
+//ゲームプレイの処理（描画や音を使わない部分）
+//ゲームプレイのステートとボットの両方がこの処理を使う
+
+// ステージの当たり判定（モデルを読み込んだあとにまとめて渡す）
+struct StageColliders
+{
+	Box boundingBox;
+	Box spiderBoundingBox;
+	Array<Box> wallBoxes;
+	Array<Box> eggBoxes;
+};
+
+// 1セッション分の状態
+struct SimulationState
+{
+	Array<Vec3> spiderPositions;
+	Array<bool> eggFire;
+	// 前フレームのプレイヤーの位置
+	Vec3 previousPlayerPosition = PlayerStartPosition;
+};
+
+// 初期状態を作る
+SimulationState MakeSimulationState(const StageColliders& stage, size_t spiderCount = 1)
+{
+	SimulationState state;
+	for (size_t i = 0; i < Max<size_t>(spiderCount, 1); ++i)
+	{
+		state.spiderPositions << (SpiderStartPosition + ExtraSpiderOffset * static_cast<double>(i));
+	}
+	state.eggFire.resize(stage.eggBoxes.size(), false);
+	return state;
+}
+
+// 1フレームの結果
+struct TickResult
+{
+	// 移動後のプレイヤーの位置（カメラや描画に使う）
+	Vec3 eyePosition{ 0, 0, 0 };
+	// 卵を燃やした
+	bool eggBurnt = false;
+	// 蜘蛛に捕まった
+	bool caught = false;
+	// 当たり判定を行った回数
+	uint32 collisionQueries = 0;
+};
+
+// ゲームプレイを1フレーム進める
+TickResult SimulateTick(const StageColliders& stage, PlayerController& player, const PlayerInput& input, SimulationState& state, double deltaTime)
+{
+	TickResult result;
+
+	// プレイヤーの位置を更新
+	result.eyePosition = player.UpdatePosition(stage.boundingBox, input, deltaTime);
+	++result.collisionQueries;
+	const Sphere playerSphere(result.eyePosition, PlayerRadius);
+
+	// Spiderがプレイヤーに向かって移動
+	for (auto& spiderPosition : state.spiderPositions)
+	{
+		Vec3 directionToPlayer = (result.eyePosition - spiderPosition);
+		directionToPlayer.y = 0; // y成分を0にする
+		spiderPosition += directionToPlayer.normalized() * (deltaTime * SpiderSpeed);
+	}
+
+	//卵を燃やしたときの処理
+	for (size_t i = 0; i < stage.eggBoxes.size(); ++i)
+	{
+		++result.collisionQueries;
+		if (playerSphere.intersects(stage.eggBoxes[i]) && input.fire)
+		{
+			state.eggFire[i] = true;
+			result.eggBurnt = true;
+		}
+	}
+
+	//蜘蛛に接触したとき
+	for (const auto& spiderPosition : state.spiderPositions)
+	{
+		++result.collisionQueries;
+		if (playerSphere.intersects(GetSpiderBoundingBox(stage.spiderBoundingBox, spiderPosition)))
+		{
+			result.caught = true;
+			return result;
+		}
+	}
+
+	// プレイヤーの位置を更新（1フレームに2回移動する）
+	player.UpdatePosition(stage.boundingBox, input, deltaTime);
+	++result.collisionQueries;
+
+	// プレイヤーが壁に当たった場合の処理
+	for (const auto& wallBox : stage.wallBoxes)
+	{
+		++result.collisionQueries;
+		if (playerSphere.intersects(wallBox)) { player.m_eyePosition = state.previousPlayerPosition; }
+	}
+
+	// 更新後のプレイヤー位置を前フレームの位置として保持
+	state.previousPlayerPosition = player.m_eyePosition;
+	return result;
+}
+
+//-------------------------------------------------------------------------
+// 
+//ボット・ベンチマーク系
+//SimulateTickをボットに操作させて結果を集計する
+
+// ボットの戦略
+enum class BotStrategy {
+	NearestEgg,	// 一番近い卵から燃やす
+	FixedOrder,	// 卵を決まった順番で燃やす
+	Evasive		// 蜘蛛が近いときは離れながら卵を目指す
+};
+
+// ベンチマークで実行・集計する戦略の一覧
+constexpr std::array<BotStrategy, 3> BotStrategies = { BotStrategy::NearestEgg, BotStrategy::FixedOrder, BotStrategy::Evasive };
+
+// 戦略の名前を取得
+String GetBotStrategyName(BotStrategy strategy)
+{
+	switch (strategy)
+	{
+	case BotStrategy::NearestEgg:
+		return U"NearestEgg";
+	case BotStrategy::FixedOrder:
+		return U"FixedOrder";
+	case BotStrategy::Evasive:
+		return U"Evasive";
+	}
+	return U"Unknown";
+}
+
+// セッションの終わり方
+enum class SessionOutcome {
+	Clear,
+	GameOver,
+	Timeout
+};
+
+// ベンチマークの設定
+struct BotBenchmarkConfig
+{
+	// 戦略ごとのセッション数
+	size_t sessionsPerStrategy = 64;
+	// 各セッションのシード（baseSeed + セッション番号）
+	uint64 baseSeed = 12345;
+	// 1ティックの時間（60FPS相当）
+	double deltaTime = 1.0 / 60.0;
+	// これを超えたら時間切れ
+	double maxSessionTime = 180.0;
+	// 蜘蛛の数（負荷を上げるときに増やす）
+	size_t spiderCount = 1;
+	// 0ならCPUのコア数
+	size_t threadCount = 0;
+};
+
+// 「--name=値」の形の引数を読む
+template <class Type>
+void ReadBotBenchmarkOption(const String& arg, StringView name, Type& value)
+{
+	if (arg.starts_with(name))
+	{
+		value = ParseOr<Type>(arg.substr(name.size()), value);
+	}
+}
+
+// コマンドライン引数からベンチマークの設定を読む（--bot-benchmark がなければ無効）
+// 例: EscapeFromSpider.exe --bot-benchmark --bot-spiders=4 --bot-sessions=256 --bot-threads=8 --bot-seed=1
+Optional<BotBenchmarkConfig> ParseBotBenchmarkConfig(const Array<String>& args)
+{
+	if (not args.includes(U"--bot-benchmark"))
+	{
+		return none;
+	}
+
+	BotBenchmarkConfig config;
+	for (const auto& arg : args)
+	{
+		ReadBotBenchmarkOption(arg, U"--bot-spiders=", config.spiderCount);
+		ReadBotBenchmarkOption(arg, U"--bot-sessions=", config.sessionsPerStrategy);
+		ReadBotBenchmarkOption(arg, U"--bot-threads=", config.threadCount);
+		ReadBotBenchmarkOption(arg, U"--bot-seed=", config.baseSeed);
+	}
+	config.spiderCount = Max<size_t>(config.spiderCount, 1);
+	return config;
+}
+
+// 1セッションの結果
+struct SessionResult
+{
+	BotStrategy strategy = BotStrategy::NearestEgg;
+	SessionOutcome outcome = SessionOutcome::Timeout;
+	// クリアまでのゲーム内時間（秒）
+	double clearTime = 0.0;
+	size_t eggsBurnt = 0;
+	uint64 ticks = 0;
+	// 当たり判定を行った回数
+	uint64 collisionQueries = 0;
+	// SimulateTickにかかった実時間（ナノ秒、時刻取得1回分のコストを含む）
+	uint64 simulationNanosec = 0;
+	// ボットの思考にかかった実時間（ナノ秒、時刻取得1回分のコストを含む）
+	uint64 botNanosec = 0;
+};
+
+// ベンチマーク全体の結果
+struct BotBenchmarkResult
+{
+	BotBenchmarkConfig config;
+	Array<SessionResult> sessions;
+	size_t threadCount = 0;
+	// Time::GetNanosec()1回あたりのコスト（ナノ秒）
+	double timerOverheadNanosec = 0.0;
+	// 全体にかかった実時間（秒）
+	double elapsedSec = 0.0;
+};
+
+// プレイヤーの入力を決めるボット
+class BotPlayer
+{
+public:
+	BotPlayer(BotStrategy strategy, uint64 seed)
+		: m_strategy{ strategy }
+		, m_rng{ seed } {}
+
+	// 現在の状況から向きと入力を決める
+	PlayerInput Think(const StageColliders& stage, PlayerController& controller, const SimulationState& state)
+	{
+		PlayerInput input;
+		const Vec3 eyePosition = controller.m_eyePosition;
+
+		// 目標の卵を選ぶ
+		Optional<size_t> target;
+		for (size_t i = 0; i < stage.eggBoxes.size(); ++i)
+		{
+			if (state.eggFire[i])
+			{
+				continue;
+			}
+			if (m_strategy == BotStrategy::FixedOrder)
+			{
+				target = i;
+				break;
+			}
+			if ((not target) || (HorizontalDistance(eyePosition, stage.eggBoxes[i].center) < HorizontalDistance(eyePosition, stage.eggBoxes[*target].center)))
+			{
+				target = i;
+			}
+		}
+		if (not target)
+		{
+			return input;
+		}
+
+		// 卵に触れていたら燃やす
+		const Box& targetBox = stage.eggBoxes[*target];
+		input.fire = Sphere{ eyePosition, PlayerRadius }.intersects(targetBox);
+
+		// 卵へ向かう方向
+		Vec3 direction = (targetBox.center - eyePosition);
+		direction.y = 0;
+		direction = direction.normalized();
+
+		// 蜘蛛が近いときは離れる方向を混ぜる
+		if (m_strategy == BotStrategy::Evasive)
+		{
+			direction += GetEvasion(stage, eyePosition, state.spiderPositions);
+		}
+
+		double angle = Atan2(direction.x, direction.z);
+
+		// 壁に引っかかっていたらしばらく横にそれる
+		if (eyePosition.distanceFrom(m_lastPosition) < 0.01)
+		{
+			++m_stuckTicks;
+		}
+		else
+		{
+			m_stuckTicks = 0;
+		}
+		m_lastPosition = eyePosition;
+		if ((10 <= m_stuckTicks) && (m_detourTicks == 0))
+		{
+			m_detourTicks = 30;
+			m_detourAngle = Random(60_deg, 120_deg, m_rng) * (RandomBool(0.5, m_rng) ? 1 : -1);
+		}
+		if (0 < m_detourTicks)
+		{
+			--m_detourTicks;
+			angle += m_detourAngle;
+		}
+
+		// 少しだけ狙いをぶらす
+		controller.m_angle = angle + Random(-5_deg, 5_deg, m_rng);
+		controller.m_pitch = 0_deg;
+		input.forward = true;
+		return input;
+	}
+
+private:
+	BotStrategy m_strategy;
+	SmallRNG m_rng;
+	Vec3 m_lastPosition{ 0, 0, 0 };
+	int32 m_stuckTicks = 0;
+	int32 m_detourTicks = 0;
+	double m_detourAngle = 0_deg;
+
+	static double HorizontalDistance(const Vec3& a, const Vec3& b)
+	{
+		return Vec2{ a.x, a.z }.distanceFrom(Vec2{ b.x, b.z });
+	}
+
+	// 一番近い蜘蛛の当たり判定から離れる方向（近いほど強い）
+	static Vec3 GetEvasion(const StageColliders& stage, const Vec3& eyePosition, const Array<Vec3>& spiderPositions)
+	{
+		// 当たり判定の大きさから逃げ始める距離を決める
+		const Vec3 halfSize = GetSpiderBoundingBox(stage.spiderBoundingBox, Vec3{ 0, 0, 0 }).size / 2;
+		const double evasionRange = (Max(halfSize.x, halfSize.z) + PlayerRadius);
+
+		Vec3 evasion{ 0, 0, 0 };
+		double nearestClearance = evasionRange;
+		for (const auto& spiderPosition : spiderPositions)
+		{
+			// 当たり判定の表面までの水平距離から、プレイヤーの半径を引いた隙間
+			const Box spiderBox = GetSpiderBoundingBox(stage.spiderBoundingBox, spiderPosition);
+			const double dx = Max(Abs(eyePosition.x - spiderBox.center.x) - halfSize.x, 0.0);
+			const double dz = Max(Abs(eyePosition.z - spiderBox.center.z) - halfSize.z, 0.0);
+			const double clearance = (Vec2{ dx, dz }.length() - PlayerRadius);
+			if (nearestClearance <= clearance)
+			{
+				continue;
+			}
+			Vec3 away = (eyePosition - spiderBox.center);
+			away.y = 0;
+			nearestClearance = clearance;
+			evasion = away.normalized() * (evasionRange / Max(clearance, 0.1) - 1.0);
+		}
+		return evasion;
+	}
+};
+
+// ボットに1セッション遊ばせる
+// controllerはメインスレッドで作ったものをコピーして使う
+SessionResult RunBotSession(const StageColliders& stage, PlayerController controller, BotStrategy strategy, uint64 seed, const BotBenchmarkConfig& config)
+{
+	const double deltaTime = config.deltaTime;
+	BotPlayer bot{ strategy, seed };
+	SimulationState state = MakeSimulationState(stage, config.spiderCount);
+
+	SessionResult result;
+	result.strategy = strategy;
+
+	const uint64 maxTicks = static_cast<uint64>(Math::Round(config.maxSessionTime / deltaTime));
+	// 時刻の取得は1ティックに2回（思考の後とゲームの処理の後）だけにする
+	uint64 lastNanosec = Time::GetNanosec();
+	while (result.ticks < maxTicks)
+	{
+		++result.ticks;
+
+		const PlayerInput input = bot.Think(stage, controller, state);
+		const uint64 thinkNanosec = Time::GetNanosec();
+		const TickResult tick = SimulateTick(stage, controller, input, state, deltaTime);
+		const uint64 tickNanosec = Time::GetNanosec();
+		result.botNanosec += (thinkNanosec - lastNanosec);
+		result.simulationNanosec += (tickNanosec - thinkNanosec);
+		lastNanosec = tickNanosec;
+		result.collisionQueries += tick.collisionQueries;
+
+		if (tick.caught)
+		{
+			result.outcome = SessionOutcome::GameOver;
+			break;
+		}
+
+		//ゲームクリア処理
+		if (state.eggFire.all())
+		{
+			result.outcome = SessionOutcome::Clear;
+			result.clearTime = (result.ticks * deltaTime);
+			break;
+		}
+	}
+
+	result.eggsBurnt = state.eggFire.count(true);
+	return result;
+}
+
+// Time::GetNanosec()1回あたりのコストを測る
+double MeasureTimerOverheadNanosec()
+{
+	constexpr uint32 Count = 100000;
+	const uint64 start = Time::GetNanosec();
+	uint64 end = start;
+	for (uint32 i = 0; i < Count; ++i)
+	{
+		end = Time::GetNanosec();
+	}
+	return static_cast<double>(end - start) / Count;
+}
+
+// すべての戦略のセッションを複数スレッドで実行
+BotBenchmarkResult RunBotBenchmark(const StageColliders& stage, const PlayerController& prototype, const BotBenchmarkConfig& config)
+{
+	const double timerOverheadNanosec = MeasureTimerOverheadNanosec();
+	const Stopwatch stopwatch{ StartImmediately::Yes };
+	const size_t sessionCount = (BotStrategies.size() * config.sessionsPerStrategy);
+
+	const size_t threadCount = Max<size_t>((config.threadCount ? config.threadCount : Threading::GetConcurrency()), 1);
+
+	// セッションをスレッドに順番に割り振る
+	Array<AsyncTask<Array<SessionResult>>> tasks;
+	for (size_t t = 0; t < threadCount; ++t)
+	{
+		tasks << Async([&, t]()
+		{
+			Array<SessionResult> sessions;
+			for (size_t i = t; i < sessionCount; i += threadCount)
+			{
+				const BotStrategy strategy = BotStrategies[i / config.sessionsPerStrategy];
+				sessions << RunBotSession(stage, prototype, strategy, (config.baseSeed + i), config);
+			}
+			return sessions;
+		});
+	}
+	BotBenchmarkResult result;
+	result.config = config;
+	result.threadCount = threadCount;
+	result.timerOverheadNanosec = timerOverheadNanosec;
+	for (auto& task : tasks)
+	{
+		result.sessions.append(task.get());
+	}
+
+	result.elapsedSec = stopwatch.sF();
+	return result;
+}
+
+// 1ティックあたりの時間（マイクロ秒）。区間ごとに1回含まれる時刻取得のコストを差し引く
+double GetPerTickMicrosec(uint64 nanosec, uint64 ticks, double timerOverheadNanosec)
+{
+	if (ticks == 0)
+	{
+		return 0.0;
+	}
+	return Max((static_cast<double>(nanosec) / ticks - timerOverheadNanosec), 0.0) / 1000.0;
+}
+
+// ベンチマークの結果をコンソールに出力
+void PrintBotBenchmarkReport(const BotBenchmarkResult& result)
+{
+	const BotBenchmarkConfig& config = result.config;
+	Console << U"spiders:{} sessions/strategy:{} threads:{} seed:{} dt:{:.4f}s limit:{:.0f}s timerOverhead:{:.1f}ns"_fmt(
+		config.spiderCount, config.sessionsPerStrategy, result.threadCount, config.baseSeed, config.deltaTime, config.maxSessionTime, result.timerOverheadNanosec);
+	uint64 totalTicks = 0;
+
+	for (const auto strategy : BotStrategies)
+	{
+		const Array<SessionResult> sessions = result.sessions.filter([&](const SessionResult& s) { return s.strategy == strategy; });
+		if (not sessions)
+		{
+			continue;
+		}
+
+		size_t clears = 0, gameOvers = 0, timeouts = 0;
+		double clearTimeSum = 0.0, eggsSum = 0.0, queriesSum = 0.0;
+		uint64 ticks = 0, simulationNanosec = 0, botNanosec = 0;
+		for (const auto& s : sessions)
+		{
+			switch (s.outcome)
+			{
+			case SessionOutcome::Clear:
+				++clears;
+				clearTimeSum += s.clearTime;
+				break;
+			case SessionOutcome::GameOver:
+				++gameOvers;
+				break;
+			case SessionOutcome::Timeout:
+				++timeouts;
+				break;
+			}
+			eggsSum += s.eggsBurnt;
+			queriesSum += s.collisionQueries;
+			simulationNanosec += s.simulationNanosec;
+			botNanosec += s.botNanosec;
+			ticks += s.ticks;
+		}
+		totalTicks += ticks;
+
+		Console << U"[{}] sessions:{} win:{:.1f}% gameover:{} timeout:{} clearTime:{:.1f}s eggs:{:.2f} queries/session:{:.0f} tick:{:.3f}us bot:{:.3f}us"_fmt(
+			GetBotStrategyName(strategy), sessions.size(), (100.0 * clears / sessions.size()), gameOvers, timeouts,
+			(clears ? (clearTimeSum / clears) : 0.0), (eggsSum / sessions.size()), (queriesSum / sessions.size()),
+			GetPerTickMicrosec(simulationNanosec, ticks, result.timerOverheadNanosec), GetPerTickMicrosec(botNanosec, ticks, result.timerOverheadNanosec));
+	}
+
+	Console << U"threads:{} elapsed:{:.2f}s throughput:{:.0f} ticks/s"_fmt(
+		result.threadCount, result.elapsedSec, (result.elapsedSec ? (totalTicks / result.elapsedSec) : 0.0));
+}
+
 // メイン関数
 void Main()
 {
@@ -283,12 +817,6 @@ void Main()
 	const Box eggBox3 = egg3.boundingBox();
 	const Box eggBox4 = egg4.boundingBox();
 
-	bool eggFire = false;
-	bool eggFire1 = false;
-	bool eggFire2 = false;
-	bool eggFire3 = false;
-	bool eggFire4 = false;
-
 	// カスタムピクセルシェーダ
 	const PixelShader ps3D = HLSL{ U"Assets/point_light.hlsl", U"PS" };
 	ConstantBuffer<PSLighting> constantBuffer;
@@ -320,20 +848,41 @@ void Main()
 
 	//スパイダーモデルの当たり判定
 	const Box spiderBoundingBox = Spider.boundingBox();
-	// スパイダーモデルの初期位置
-	Vec3 spiderPosition{ 0, -0.62, 10 };
+
+	//当たり判定をまとめる（ゲームプレイとボットで共通）
+	const StageColliders stageColliders{
+		boundingBox,
+		spiderBoundingBox,
+		{ walldoubleBox, walldoubleBox1, walldoubleBox2, walldoubleBox3, walldoubleBox4,
+		  walldoubleBox5, walldoubleBox6, walldoubleBox7, walldoubleBox8, walldoubleBox9,
+		  walldoubleBox10, walldoubleBox11, walldoubleBox12, walldoubleBox13, walldoubleBox14,
+		  walldoubleBox15, walldoubleBox16, walldoubleBox17, walldoubleBox18, walldoubleBox19,
+		  walldoubleBox20, walldoubleBox21, walldoubleBox22, walldoubleBox23, walldoubleBox24,
+		  wallboxBox, wallboxBox1, wallboxBox2, wallboxBox3, wallboxBox4, wallboxBox5, wallboxBox6 },
+		{ eggBox, eggBox1, eggBox2, eggBox3, eggBox4 }
+	};
 
 	// PlayerControllerのインスタンス作成
 	PlayerController playerController;
 
-	// 前フレームのプレイヤーの位置を保持する変数
-	Vec3 previousPlayerPosition = playerController.m_eyePosition;
+	// 卵・スパイダー・前フレームのプレイヤーの位置を保持する変数
+	SimulationState simulation = MakeSimulationState(stageColliders);
+
+	//ボット・ベンチマーク（--bot-benchmark を付けて起動したときだけ使える）
+	const Optional<BotBenchmarkConfig> botBenchmarkConfig = ParseBotBenchmarkConfig(System::GetCommandLineArgs());
+	AsyncTask<BotBenchmarkResult> botBenchmarkTask;
 
 	double alpha = 0.2;
 	bool increasing = true;
 	// アップデート
 	while (System::Update())
 	{
+		//ベンチマークが終わったら結果を出力
+		if (botBenchmarkTask.isReady())
+		{
+			PrintBotBenchmarkReport(botBenchmarkTask.get());
+		}
+
 		switch (currentState)
 		{
 
@@ -361,6 +910,16 @@ void Main()
 			}
 			EggPNG.draw();
 			Title.draw();
+			//Bキーでボットによるベンチマークを別スレッドで開始（実行中は無視）
+			if (botBenchmarkConfig && (not botBenchmarkTask.isValid()) && KeyB.down())
+			{
+				Console << U"Bot benchmark started.";
+				// PlayerControllerはメインスレッドで作ってから渡す
+				botBenchmarkTask = Async([&stageColliders, prototype = PlayerController{}, config = *botBenchmarkConfig]()
+				{
+					return RunBotBenchmark(stageColliders, prototype, config);
+				});
+			}
 			//ボタンが押されたらゲームプレイに遷移
 			if (SimpleGUI::Button(U"StartGame", startButton.leftCenter(), 100))
 			{
@@ -395,13 +954,8 @@ void Main()
 			if (SimpleGUI::Button(U"BacktoTitle", startButton.leftCenter(), 100))
 			{
 				//リセット
-				eggFire = false;
-				eggFire1 = false;
-				eggFire2 = false;
-				eggFire3 = false;
-				eggFire4 = false;
-				spiderPosition = { 0, -0.62, 10 };
-				playerController.m_eyePosition = { 100, 2, -16 };
+				simulation = MakeSimulationState(stageColliders);
+				playerController.m_eyePosition = PlayerStartPosition;
 				currentState = GameState::Title;
 			}
 		}
@@ -411,7 +965,7 @@ void Main()
 		case GameState::Gameplay:
 		{
 			//ゲームクリア処理
-			if (eggFire && eggFire1 && eggFire2 && eggFire3 && eggFire4)
+			if (simulation.eggFire.all())
 			{
 				currentState = GameState::GameClear;
 			}
@@ -420,14 +974,15 @@ void Main()
 			const double fogCoefficient = Math::Eerp(0.001, 0.5, fogParam);
 			cb->fogCoefficient = static_cast<float>(fogCoefficient);
 			const ScopedCustomShader3D shader{ ps3D };
-			//時間
-			const double deltaTime = Scene::DeltaTime();
 			// マウスの処理
 			playerController.HandleMouse();
-			// プレイヤーの位置を更新
-			const Vec3 eyePosition = playerController.UpdatePosition(boundingBox);
+			// ゲームの処理を1フレーム進める（移動・スパイダー・卵・壁の当たり判定）
+			const TickResult tick = SimulateTick(stageColliders, playerController, PlayerController::GetKeyboardInput(), simulation, Scene::DeltaTime());
+			const Vec3 eyePosition = tick.eyePosition;
+			// プレイヤーが注目している位置（1回目の移動後の位置から）
+			const Vec3 focusPosition = eyePosition + playerController.GetDirection(playerController.m_angle, playerController.m_pitch);
 			// カメラのビューを更新
-			camera.setView(eyePosition, playerController.GetFocusPosition());
+			camera.setView(eyePosition, focusPosition);
 			Graphics3D::SetCameraTransform(camera);
 
 			// 3Dレンダリング
@@ -439,30 +994,28 @@ void Main()
 				boundingBox.drawFrame(Palette::Red);
 
 				// プレイヤーの現在位置を球で表示
-				const Sphere playerSphere(eyePosition, 0.5);
+				const Sphere playerSphere(eyePosition, PlayerRadius);
 				playerSphere.draw(Palette::Blue);
-				// プレイヤーに向かう方向ベクトルを計算
-				Vec3 directionToPlayer = (eyePosition - spiderPosition);
-				directionToPlayer.y = 0; // y成分を0にする
-				directionToPlayer = directionToPlayer.normalized();
-				// Y軸を中心とした回転角度を計算
-				double yaw = Atan2(directionToPlayer.x, directionToPlayer.z);
-				// Spiderの変換行列を生成
-				Mat4x4 spiderTransform = Mat4x4::Scale(1) * Mat4x4::RotateY(yaw) * Mat4x4::Translate(spiderPosition);
-				// 描画
-				Spider.draw(spiderTransform);
-				// Spiderがプレイヤーに向かって移動する速度
-				double spiderSpeed = deltaTime * 8.0;
-				// Spiderの位置を更新
-				spiderPosition += directionToPlayer * spiderSpeed;
-
-				// スパイダーのバウンディングボックスを動的に更新
-				Box dynamicSpiderBoundingBox = GetSpiderBoundingBox(Spider, spiderPosition);
-				//dynamicSpiderBoundingBox.drawFrame(Palette::Green);
+
+				// Spiderとプレイヤーの距離
+				double distance = Math::Inf;
+				for (const auto& spiderPosition : simulation.spiderPositions)
+				{
+					// プレイヤーに向かう方向ベクトルを計算
+					Vec3 directionToPlayer = (eyePosition - spiderPosition);
+					directionToPlayer.y = 0; // y成分を0にする
+					directionToPlayer = directionToPlayer.normalized();
+					// Y軸を中心とした回転角度を計算
+					double yaw = Atan2(directionToPlayer.x, directionToPlayer.z);
+					// Spiderの変換行列を生成
+					Mat4x4 spiderTransform = Mat4x4::Scale(1) * Mat4x4::RotateY(yaw) * Mat4x4::Translate(spiderPosition);
+					// 描画
+					Spider.draw(spiderTransform);
+					//GetSpiderBoundingBox(spiderBoundingBox, spiderPosition).drawFrame(Palette::Green);
+					distance = Min(distance, spiderPosition.distanceFrom(eyePosition));
+				}
 
 				//心音
-				// Spiderとプレイヤーの距離を計算
-				double distance = spiderPosition.distanceFrom(eyePosition);
 				double Volume = -(distance/12) + 4;
 				if (Volume < 0.0){
 					Volume = 0.0;
@@ -552,7 +1105,7 @@ void Main()
 				//eggBox4.drawFrame(Palette::Orange);
 
 				// ライターモデルをカメラの前に表示
-				Vec3 cameraDirection = playerController.GetFocusPosition() - eyePosition;
+				Vec3 cameraDirection = focusPosition - eyePosition;
 				Vec3 offsetFromCamera = cameraDirection.cross(Vec3{ 0, 1, 0 }).normalized() * -0.1; // 右方向へのオフセット
 				offsetFromCamera.y -= 0.1; // 下方向へのオフセット
 				Vec3 lighterPosition = eyePosition + cameraDirection.normalized() * 0.3 + offsetFromCamera;
@@ -566,92 +1119,20 @@ void Main()
 				Lighter.draw(lighterPosition);
 
 				//卵を燃やしたときの処理
-				if (playerSphere.intersects(eggBox)){
-					if (MouseL.down()){
-						eggFire = true;
-						fire.play();
-					}
-				}
-				if (playerSphere.intersects(eggBox1)){
-					if (MouseL.down()){
-						eggFire1 = true;
-						fire.play();
-					}
-				}
-				if (playerSphere.intersects(eggBox2)){
-					if (MouseL.down()) {
-						eggFire2 = true;
-						fire.play();
-					}
-				}
-				if (playerSphere.intersects(eggBox3)){
-					if (MouseL.down()) {
-						eggFire3 = true;
-						fire.play();
-					}
-				}
-				if (playerSphere.intersects(eggBox4)){
-					if (MouseL.down()) {
-						eggFire4 = true;
-						fire.play();
-					}
+				if (tick.eggBurnt)
+				{
+					fire.play();
 				}
 
 				//蜘蛛に接触したとき
-				if (playerSphere.intersects(dynamicSpiderBoundingBox))
+				if (tick.caught)
 				{
 					//Print << U"餌になった..";
 					//リセット
-					eggFire = false;
-					eggFire1 = false;
-					eggFire2 = false;
-					eggFire3 = false;
-					eggFire4 = false;
-					spiderPosition = { 0, -0.62, 10 };
-					playerController.m_eyePosition = { 100, 2, -16 };
+					simulation = MakeSimulationState(stageColliders);
+					playerController.m_eyePosition = PlayerStartPosition;
 					currentState = GameState::GameOver;
 				}
-
-				// プレイヤーの位置を更新
-				Vec3 eyePosition = playerController.UpdatePosition(boundingBox);
-
-				// プレイヤーが壁に当たった場合の処理
-				if (playerSphere.intersects(walldoubleBox)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox1)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox2)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox3)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox4)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox5)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox6)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox7)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox8)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox9)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox10)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox11)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox12)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox13)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox14)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox15)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox16)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox17)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox18)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox19)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox20)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox21)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox22)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox23)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(walldoubleBox24)) { playerController.m_eyePosition = previousPlayerPosition; }
-
-				if (playerSphere.intersects(wallboxBox)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(wallboxBox1)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(wallboxBox2)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(wallboxBox3)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(wallboxBox4)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(wallboxBox5)) { playerController.m_eyePosition = previousPlayerPosition; }
-				if (playerSphere.intersects(wallboxBox6)) { playerController.m_eyePosition = previousPlayerPosition; }
-
-				// 更新後のプレイヤー位置を前フレームの位置として保持
-				previousPlayerPosition = playerController.m_eyePosition;
 			}
 
 			// レンダリング結果を画面に表示